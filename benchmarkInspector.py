@@ -0,0 +1,85 @@
+import os, sys
+import subprocess
+import time
+import json
+import itertools
+from optparse import OptionParser
+
+#### scaling benchmark of the inspector:
+#### builds synthetic workspaces (makeSyntheticWorkspace.C) over a grid of model sizes,
+#### runs the compiled inspector with --bench on each of them and collects the per-phase
+#### timing / memory of all the runs in a single JSON file
+
+def intList(option):
+    return [int(x) for x in option.split(",") if x!=""]
+
+parser=OptionParser(usage="python benchmarkInspector.py [options]")
+parser.add_option("--channels", dest="channels", default="2,8,32",  help="comma separated list of number of channels (2,8,32)")
+parser.add_option("--samples",  dest="samples",  default="4",       help="comma separated list of samples per channel (4)")
+parser.add_option("--bins",     dest="bins",     default="10",      help="comma separated list of bins per channel (10)")
+parser.add_option("--overall",  dest="overall",  default="10",      help="comma separated list of OverallSys per sample (10)")
+parser.add_option("--histo",    dest="histo",    default="2",       help="comma separated list of HistoSys per sample (2)")
+parser.add_option("--threads",  dest="threads",  default="1",       help="comma separated list of inspector threads (1)")
+parser.add_option("--no-stat",  dest="stat",     action="store_false", default=True, help="no MC stat errors (gamma_stat)")
+parser.add_option("-o","--output", dest="output", default="./benchmark", help="work directory (./benchmark)")
+parser.add_option("--label",    dest="label",    default="",        help="tag of this run (e.g. the release), stored in the results")
+parser.add_option("--exe",      dest="exe",      default=os.path.join(os.path.dirname(os.path.abspath(__file__)),"inspector_build","runInspector"), help="runInspector executable")
+(options, args) = parser.parse_args()
+
+if not os.path.isfile(options.exe):
+    print(" ")
+    print(" executable '"+options.exe+"' not found, build it with: mkdir inspector_build && cd inspector_build && cmake .. && make -j")
+    print(" ")
+    sys.exit(1)
+macro=os.path.join(os.path.dirname(os.path.abspath(__file__)),"makeSyntheticWorkspace.C")
+
+results=[]
+grid=itertools.product(intList(options.channels), intList(options.samples), intList(options.bins), intList(options.overall), intList(options.histo))
+for (nCh, nSam, nBin, nOver, nHisto) in grid:
+    name="synth_ch%d_s%d_b%d_o%d_h%d%s" % (nCh, nSam, nBin, nOver, nHisto, "" if options.stat else "_nostat")
+    prefix=os.path.join(options.output,"workspaces",name)
+    WSfile=prefix+"_combined_meas_model.root"
+    genTime=0.
+    if not os.path.isfile(WSfile):
+        start=time.time()
+        command='%s+(%d,%d,%d,%d,%d,%s,"%s")' % (macro, nCh, nSam, nBin, nOver, nHisto, "true" if options.stat else "false", prefix)
+        log=open(prefix+"_make.log","w") if os.path.isdir(os.path.dirname(prefix)) else None
+        if log==None:
+            os.makedirs(os.path.dirname(prefix))
+            log=open(prefix+"_make.log","w")
+        subprocess.call(["root","-l","-b","-q",command], stdout=log, stderr=subprocess.STDOUT)
+        log.close()
+        genTime=time.time()-start
+    if not os.path.isfile(WSfile):
+        print(" could not make "+WSfile+", see "+prefix+"_make.log")
+        continue
+
+    for nThreads in intList(options.threads):
+        outDir=os.path.join(options.output,"runs",name+"_t%d" % nThreads)+"/"
+        if not os.path.isdir(outDir):
+            os.makedirs(outDir)
+        # the run folder is reused: never pick up the numbers of a previous (e.g. older release) run
+        benchFile=os.path.join(outDir,"Checks","benchmark.json")
+        if os.path.isfile(benchFile):
+            os.remove(benchFile)
+        log=open(os.path.join(outDir,"log"),"w")
+        start=time.time()
+        status=subprocess.call([options.exe, WSfile, "-o", outDir, "-j", str(nThreads), "--bench", "--no-index"], stdout=log, stderr=subprocess.STDOUT)
+        log.close()
+        if status!=0 or not os.path.isfile(benchFile):
+            print(" run on "+WSfile+" failed (exit code "+str(status)+"), see "+os.path.join(outDir,"log"))
+            continue
+        bench=json.load(open(benchFile))
+        bench["config"]={"channels":nCh, "samples":nSam, "bins":nBin, "overallSys":nOver, "histoSys":nHisto, "statErrors":options.stat, "threads":nThreads}
+        bench["generation_s"]=genTime
+        bench["total_s"]=time.time()-start
+        results.append(bench)
+        phases=" ".join(["%s=%.2fs" % (p["name"], p["real_s"]) for p in bench["phases"]])
+        peak=max([p["peak_rss_kB"] for p in bench["phases"]]) if len(bench["phases"])>0 else 0
+        workerPeak=max([p.get("worker_peak_rss_kB",0) for p in bench["phases"]]) if len(bench["phases"])>0 else 0
+        print(" %-40s threads=%-3d total=%7.2fs peak=%8d kB workers=%8d kB  %s" % (name, nThreads, bench["total_s"], peak, workerPeak, phases))
+
+outName=os.path.join(options.output,"benchmark_results%s.json" % ("_"+options.label if options.label!="" else ""))
+json.dump({"label":options.label, "date":time.strftime("%Y-%m-%d %H:%M:%S"), "runs":results}, open(outName,"w"), indent=1)
+print(" ")
+print(" results of "+str(len(results))+" runs written to "+outName)
@@ -0,0 +1,46 @@
+import os, sys
+import subprocess
+import filecmp
+from optparse import OptionParser
+
+#### consistency check of the systematic engine: the serial FillSysInfo (-j 1) and the forked workers (-j N)
+#### have to write byte-identical Checks/SysTensor.bin files for the same workspace
+
+parser=OptionParser(usage="python checkSysTensorThreads.py [options] [WS file]")
+parser.add_option("-j","--threads", dest="threads", type="int", default=4,        help="workers of the parallel run (4)")
+parser.add_option("-w",             dest="wsName",  default="combined",           help="workspace name (combined)")
+parser.add_option("-d",             dest="dataName",default="obsData",            help="data name (obsData)")
+parser.add_option("-o","--output",  dest="output",  default="./testThreads",      help="work directory (./testThreads)")
+parser.add_option("--exe",          dest="exe",     default=os.path.join(os.path.dirname(os.path.abspath(__file__)),"inspector_build","runInspector"), help="runInspector executable")
+(options, args) = parser.parse_args()
+
+# default: the two-channel example built by example.C from example1.root and example2.root
+WSfile=args[0] if len(args)>0 else "./results/example_UsingC_twochannel_combined_meas_model.root"
+if not os.path.isfile(WSfile):
+    print(" workspace '"+WSfile+"' not found, make it with: root -b -q example.C")
+    sys.exit(1)
+if not os.path.isfile(options.exe):
+    print(" executable '"+options.exe+"' not found, build it with: mkdir inspector_build && cd inspector_build && cmake .. && make -j")
+    sys.exit(1)
+
+tensors=[]
+for nThreads in [1, options.threads]:
+    outDir=os.path.join(options.output,"j%d" % nThreads)+"/"
+    if not os.path.isdir(outDir):
+        os.makedirs(outDir)
+    tensor=os.path.join(outDir,"Checks","SysTensor.bin")
+    if os.path.isfile(tensor):
+        os.remove(tensor)
+    log=open(os.path.join(outDir,"log"),"w")
+    status=subprocess.call([options.exe, WSfile, "-w", options.wsName, "-d", options.dataName, "-o", outDir, "-j", str(nThreads), "--no-index"], stdout=log, stderr=subprocess.STDOUT)
+    log.close()
+    if status!=0 or not os.path.isfile(tensor):
+        print(" run with -j "+str(nThreads)+" failed (exit code "+str(status)+"), see "+os.path.join(outDir,"log"))
+        sys.exit(1)
+    tensors.append(tensor)
+
+if filecmp.cmp(tensors[0], tensors[1], shallow=False):
+    print(" OK: "+tensors[0]+" and "+tensors[1]+" are identical")
+    sys.exit(0)
+print(" FAILED: "+tensors[0]+" and "+tensors[1]+" differ")
+sys.exit(1)
@@ -6,10 +6,11 @@ import time
 
 def help():
     print " "
-    print "python runInspector.py <WS file>  <WS name>  <data name> "
+    print "python runInspector.py <WS file>  <WS name>  <data name>  <output dir>"
     print "* <WS file> is MANDATORY"
     print "* <WS name> (combined)"
     print "* <data name> (obsData)"
+    print "* <output dir> (./test)"
     print " "
 
 if len(sys.argv)==1:
@@ -21,6 +22,7 @@ if len(sys.argv)==1:
 WSfile  =""
 WSname  ="combined"
 dataName="obsData"
+outDir  ="./test"
 
 WSfile=sys.argv[1]
 if not os.path.isfile(WSfile):
@@ -31,6 +33,10 @@ if not os.path.isfile(WSfile):
 
 if len(sys.argv)>2:
     WSname=sys.argv[2]
+if len(sys.argv)>3:
+    dataName=sys.argv[3]
+if len(sys.argv)>4:
+    outDir=sys.argv[4]
 Rfile=TFile(WSfile)
 theWS=None
 theWS=Rfile.Get(WSname)
@@ -42,8 +48,14 @@ if theWS==None:
 Rfile.Close()
 
 #### and now the real command
-gROOT.ProcessLine(".L WSinspector.C++g")
-command="LimitCrossCheck::PlotFitCrossChecks(\""+WSfile+"\",\"./test\",\""+WSname+"\" ,\"ModelConfig\" ,\""+dataName+"\")"
+#### use the library from the CMake build if there is one, otherwise let ACLiC build an optimised one (only when the source changed)
+libFile=os.path.join(os.path.dirname(os.path.abspath(__file__)),"inspector_build","libWSinspector.so")
+if os.path.isfile(libFile):
+    gSystem.Load(libFile)
+    gInterpreter.Declare("namespace LimitCrossCheck { void PlotFitCrossChecks(const char*, const char*, const char*, const char*, const char*); }")
+else:
+    gROOT.ProcessLine(".L WSinspector.C+O")
+command="LimitCrossCheck::PlotFitCrossChecks(\""+WSfile+"\",\""+outDir+"\",\""+WSname+"\" ,\"ModelConfig\" ,\""+dataName+"\")"
 print " "
 print "=========================================================================================================================================================================================="
 print command
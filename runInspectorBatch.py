@@ -0,0 +1,103 @@
+import glob, os, sys
+import subprocess
+import time
+import json
+from optparse import OptionParser
+from multiprocessing.pool import ThreadPool
+
+#### runs the compiled inspector (see CMakeLists.txt) on many workspaces, a bounded number at a time,
+#### each one in its own output directory, and collects everything in a single summary
+
+def outputName(WSfile):
+    # combined/500.root and other/500.root must not end up in the same folder
+    name=os.path.splitext(os.path.normpath(WSfile))[0]
+    return name.replace("../","").replace("./","").replace("/","_")
+
+def readSummary(fileName):
+    summary={}
+    if not os.path.isfile(fileName):
+        return summary
+    for line in open(fileName):
+        items=line.split(None,1)
+        if len(items)==2:
+            summary[items[0]]=items[1].strip()
+    return summary
+
+def runOne(args):
+    exe, WSfile, outDir, extra = args
+    if not os.path.isdir(outDir):
+        os.makedirs(outDir)
+    command=[exe, WSfile, "-o", outDir+"/"]+extra
+    start=time.time()
+    log=open(os.path.join(outDir,"log"),"w")
+    status=subprocess.call(command, stdout=log, stderr=subprocess.STDOUT)
+    log.close()
+    result=readSummary(os.path.join(outDir,"Checks","summary.txt"))
+    result["file"]=WSfile
+    result["output"]=outDir
+    result["exitcode"]=status
+    result["walltime"]="%.1f" % (time.time()-start)
+    if "status" not in result:
+        result["status"]="crashed"
+    return result
+
+parser=OptionParser(usage="python runInspectorBatch.py [options] <WS files or globs>")
+parser.add_option("-j","--jobs",    dest="jobs",    type="int", default=4,           help="workspaces inspected at the same time (4)")
+parser.add_option("-t","--threads", dest="threads", type="int", default=1,           help="threads per inspector job (1)")
+parser.add_option("-o","--output",  dest="output",  default="./batch",               help="base output directory (./batch)")
+parser.add_option("-w","--wsname",  dest="wsname",  default="combined",              help="WS name (combined)")
+parser.add_option("-d","--data",    dest="data",    default="obsData",               help="data name (obsData)")
+parser.add_option("-l","--list",    dest="list",    default="",                      help="text file with one WS file (or glob) per line")
+parser.add_option("--exe",          dest="exe",     default=os.path.join(os.path.dirname(os.path.abspath(__file__)),"inspector_build","runInspector"), help="runInspector executable")
+parser.add_option("--ranking",      dest="ranking", action="store_true", default=False, help="run the NP ranking fits")
+(options, args) = parser.parse_args()
+
+patterns=list(args)
+if options.list!="":
+    patterns+=[l.strip() for l in open(options.list) if l.strip()!="" and not l.startswith("#")]
+WSfiles=[]
+for pattern in patterns:
+    for f in sorted(glob.glob(pattern)):
+        if f not in WSfiles:
+            WSfiles.append(f)
+if len(WSfiles)==0:
+    print(" ")
+    print(" NO workspace file found")
+    parser.print_help()
+    sys.exit(1)
+if not os.path.isfile(options.exe):
+    print(" ")
+    print(" executable '"+options.exe+"' not found, build it with: mkdir inspector_build && cd inspector_build && cmake .. && make -j")
+    print(" ")
+    sys.exit(1)
+
+extra=["-w",options.wsname,"-d",options.data,"-j",str(options.threads)]
+if options.ranking:
+    extra.append("--ranking")
+jobs=[(options.exe, f, os.path.join(options.output,outputName(f)), extra) for f in WSfiles]
+
+print(" inspecting "+str(len(jobs))+" workspaces, "+str(options.jobs)+" at a time")
+start=time.time()
+pool=ThreadPool(options.jobs)
+results=pool.map(runOne, jobs)
+pool.close()
+pool.join()
+
+#### aggregated summary
+if not os.path.isdir(options.output):
+    os.makedirs(options.output)
+out=open(os.path.join(options.output,"summary.txt"),"w")
+header="%-60s | %-8s | %8s | %7s | %7s | %5s | %s" % ("file","status","time[s]","regions","samples","NPs","output")
+out.write(header+"\n")
+print(header)
+for r in results:
+    line="%-60s | %-8s | %8s | %7s | %7s | %5s | %s" % (r["file"], r["status"], r.get("realtime",r["walltime"]), r.get("regions","-"), r.get("samples","-"), r.get("nps","-"), r["output"])
+    out.write(line+"\n")
+    print(line)
+out.close()
+json.dump(results, open(os.path.join(options.output,"summary.json"),"w"), indent=1)
+
+nFailed=len([r for r in results if r["status"]!="ok"])
+print(" ")
+print(" done in %.1f s, %d/%d failed, summary in %s" % (time.time()-start, nFailed, len(results), os.path.join(options.output,"summary.txt")))
+sys.exit(1 if nFailed>0 else 0)